@@ -9,9 +9,26 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h> //for board delay purposes
+#include <string.h> //for edit script commands
+
+//frame export needs pthreads and popen, so it's only built on POSIX systems. Define NO_FRAME_EXPORT to leave it out, or FRAME_EXPORT to force it in
+#if !defined(FRAME_EXPORT) && !defined(NO_FRAME_EXPORT) && (defined(__unix__) || defined(__APPLE__))
+#define FRAME_EXPORT
+#endif
+
+#ifdef FRAME_EXPORT
+#include <pthread.h> //frame export workers, compile with -pthread
+#include <signal.h> //so a frame export command that exits early doesn't take the game down with it
+#include <sys/wait.h> //exit code of the frame export command
+#include <limits.h> //largest frame that can be exported
+#include <stdint.h>
+#endif
 
 #define N 2 //board_size array size controller; not needed but if more info needed to be stored here, easier to do this way
 #define FMAX 1000 //file reader max
+#define SMAX 256 //edit script word/file name max
+#define EXPORT_SLOTS 8 //frames that can be queued for export before the game has to wait for the encoders
+#define EXPORT_WORKERS 4 //frame encoding threads
 
 typedef unsigned int uint; //usual scanf = 0 will catch negative numbers
 
@@ -20,11 +37,72 @@ typedef struct {
 	int next_gen; //stored info for update
 } board_cell;
 
+typedef struct {
+	uint top, left; //board cell shown in the top left corner of the view
+	uint rows, cols; //size of the view in characters
+	uint zoom; //each character stands for a zoom x zoom block of cells
+	int pan_i, pan_j; //rows and columns the view moves by every generation
+} viewport;
+
+typedef struct {
+	const char *name; //name used to stamp it from edit scripts
+	uint rows, cols; //cols can be at most 64
+	const unsigned long long *bits; //one word per row, bit j is set when column j is alive
+} pattern;
+
+typedef struct {
+	const char *name; //library pattern
+	uint i, j; //top left corner on the board
+} placement;
+
+#ifdef FRAME_EXPORT
+typedef struct {
+	unsigned char *cells; //copy of every status at the time the frame was queued
+	unsigned char *out; //encoded frame
+	size_t out_size;
+	uint gen;
+	int state; //0 free, 1 waiting to be encoded, 2 encoded and waiting to be written
+} export_frame;
+
+typedef struct {
+	int format; //1 PBM image per frame, 2 PGM image per frame, 3 raw 8 bit frames piped to a command
+	uint scale; //pixels per cell side
+	uint stride; //export every stride'th generation
+	uint board_size[N];
+	uint width, height; //frame size in pixels
+	FILE *stream; //pipe for format 3
+	export_frame slots[EXPORT_SLOTS]; //ring of reused frame buffers, frame number k lives in slot k % EXPORT_SLOTS
+	uint next_submit, next_encode, next_write; //frame numbers, next_write <= next_encode <= next_submit
+	int writing; //a worker is writing frames out, only one at a time so they come out in order
+	int stopping;
+	int failed; //a frame couldn't be written, nothing more gets queued or written
+	void (*old_sigpipe)(int); //SIGPIPE handler to put back once the pipe is closed
+	int worker_count; //workers that actually started
+	pthread_t workers[EXPORT_WORKERS];
+	pthread_mutex_t lock;
+	pthread_cond_t changed; //broadcast whenever a frame moves from one state to the next
+} frame_exporter;
+#else
+typedef int frame_exporter; //not built, ExportMenu always gives NULL
+#endif
+
+typedef struct {
+	int *left, *right; //wrapped column either side of every column, from GenerateWrap
+	uint **Density; //summed-area table kept by the viewport mode step
+} step_tables;
+
+typedef void (*board_step)(board_cell **Board, uint board_size[N], step_tables *tables); //runs one whole generation
+
+typedef struct {
+	const char *name;
+	board_step step;
+} engine;
+
 /* Prototype functions */
 
 /*		Main functions	*/
 board_cell **GenerateBoard(uint board_size[N]); //BOARD GENERATING FUNCTION
-void Ticker(float delay, board_cell **Board, uint board_size[N], int End_Generation, int grid);	//MAIN TICK MANAGEMENT FUNCTION
+void Ticker(float delay, board_cell **Board, uint board_size[N], int End_Generation, int grid, int frames);	//MAIN TICK MANAGEMENT FUNCTION
 void TimeControl(float sec); //for delays to prevent board print spam
 void FreeMemory(board_cell **Board, uint board_size[N]); //frees memory after usage
 
@@ -32,8 +110,31 @@ void FreeMemory(board_cell **Board, uint board_size[N]); //frees memory after us
 void PrintBoard(board_cell **Board, uint board_size[N]); //print
 void PrintBoardGrid(board_cell **Board, uint board_size[N]); //PrintBoard but with a grid along top and side
 void BoardScan(board_cell **Board, uint board_size[N]); //neighbour check
+void BoardScanFast(board_cell **Board, uint board_size[N], int *left, int *right); //BoardScan with the wrap around looked up in tables
+int *GenerateWrap(uint board_size[N], int q); //jadd(j, q) for every column j, worked out once per run for BoardScanFast
 void BoardUpdate(board_cell **Board, uint board_size[N]);
 void ClearNextGen(board_cell **Board, uint board_size[N]); //wipes next_gen Board info
+void DisplayBoard(board_cell **Board, uint board_size[N], int grid); //prints the board in the current display mode
+
+/*		Viewport functions		*/
+uint **GenerateDensity(uint board_size[N]); //summed-area table of live cells, used for zoomed out views
+void FreeDensity(uint **Density, uint board_size[N]);
+void DensityUpdate(board_cell **Board, uint board_size[N], uint **Density); //rebuilds the table from status
+void BoardUpdateDensity(board_cell **Board, uint board_size[N], uint **Density); //BoardUpdate that also rebuilds the table
+uint DensityCount(uint **Density, uint board_size[N], uint i, uint j, uint h, uint w); //live cells in a block, wraps around
+void PrintBoardViewport(board_cell **Board, uint board_size[N], uint **Density, viewport *view);
+void ViewportPan(viewport *view, uint board_size[N]);
+
+/*		Frame export functions		*/
+void ExportSubmit(frame_exporter *Export, board_cell **Board, uint gen); //queues a generation, only waits if every slot is busy
+void ExportClose(frame_exporter *Export); //writes out everything still queued and frees the exporter
+#ifdef FRAME_EXPORT
+frame_exporter *ExportOpen(int format, uint scale, uint stride, const char *command, uint board_size[N]); //NULL if it couldn't be set up
+size_t ExportFrameBytes(uint board_size[N], uint scale); //bytes an 8 bit frame needs, 0 if it's too big to export
+void *ExportWorker(void *arg);
+void ExportEncode(frame_exporter *Export, export_frame *Frame);
+int ExportWrite(frame_exporter *Export, export_frame *Frame); //-1 if the frame couldn't be written
+#endif
 
 /*		Board manipulator functions		*/
 int iadd(int i, int p, uint board_size[N]); // function that handles edges of board for i
@@ -43,37 +144,78 @@ int FileCountCols();
 int FileCountRows(int Cols);
 
 /*		Menu functions		*/
-void PlayMenu(int grid);
-void CustomPlay(int grid);
-void PreDefBoardMenu(int grid);
+void PlayMenu(int grid, int frames);
+void CustomPlay(int grid, int frames);
+void PreDefBoardMenu(int grid, int frames);
 void CustomiseBoard(board_cell **Board, uint board_size[N], int grid);
 void SaveMenu(board_cell **Board, uint board_size[N]);
-void LoadMenu(int grid);
+void LoadMenu(int grid, int frames);
+void ViewportMenu(viewport *view, uint board_size[N]);
+frame_exporter *ExportMenu(uint board_size[N]);
+void ScriptMenu(board_cell **Board, uint board_size[N], int grid);
 
 /*		File functions		*/
 void FileLoad(board_cell **Board, uint board_size[N]);//format of files must be X[SPACE]X[SPACE]X[SPACE].. where X is 0 or 1. must be the right board size
 void FileSave(board_cell **Board, uint board_size[N]);
 
-/*		Functions for pre-defined boards		*/
-void BoardOscillatorLoad(board_cell **Board);
-void BoardSpaceshipLoad(board_cell **Board);
+/*		Edit script functions		*/
+int ScriptApply(board_cell **Board, uint board_size[N], const char *filename); //runs every command in a script, returns commands applied or -1
+int ScriptNumbers(char **text, uint *numbers, int count); //reads count numbers from the start of text, returns how many were read
+void ScriptCell(board_cell **Board, uint i, uint j, int mode); //mode 0 clears, 1 sets, 2 toggles
+void ScriptFill(board_cell **Board, uint board_size[N], uint i, uint j, uint h, uint w, int mode); //mode as ScriptCell, clipped to the board
+void ScriptRandom(board_cell **Board, uint board_size[N], uint i, uint j, uint h, uint w, float density);
+int RLEStamp(board_cell **Board, uint board_size[N], const char *filename, uint i0, uint j0); //stamps live cells of a .rle file, -1 if unreadable
+int LibraryStamp(board_cell **Board, uint board_size[N], const char *name, uint i0, uint j0, int rotation); //stamps a library pattern or built in board, -1 if unknown
 
-
-
-int main()
+/*		Functions for pre-defined boards		*/
+void BoardOscillatorLoad(board_cell **Board, uint board_size[N], uint i0, uint j0);
+void BoardSpaceshipLoad(board_cell **Board, uint board_size[N], uint i0, uint j0);
+
+/*		Pattern library functions		*/
+const pattern *PatternFind(const char *name); //looks a pattern up by name, NULL if there isn't one
+void PatternStamp(board_cell **Board, uint board_size[N], const pattern *pat, uint i0, uint j0, int rotation);
+uint LowestBit(unsigned long long bits); //index of the lowest set bit, bits must not be 0
+
+/*		Verification functions		*/
+int VerifyEngines(uint cases, uint generations, uint seed); //checks every engine against the reference, returns 0 if they all match
+int VerifyCase(board_cell **Start, uint board_size[N], uint generations, const char *label); //returns the number of engines that disagree
+int VerifyRandom(uint board_size[N], float density, uint generations, const char *label); //random start at density, returns the number of mismatches
+uint VerifyRun(board_cell **Start, uint board_size[N], board_step step, uint generations); //first generation that differs, 0 if none
+void VerifyReduce(board_cell **Start, uint board_size[N], board_step step, uint generation); //shrinks and prints a failing case
+void StepReference(board_cell **Board, uint board_size[N], step_tables *tables);
+void StepFast(board_cell **Board, uint board_size[N], step_tables *tables);
+void StepFastDensity(board_cell **Board, uint board_size[N], step_tables *tables);
+int VerifyDensity(board_cell **Start, uint board_size[N], uint generations, const char *label); //checks DensityCount against counting cells, 0 if they agree
+void BoardCopy(board_cell **Dest, board_cell **Source, uint board_size[N]);
+unsigned long long BoardHash(board_cell **Board, uint board_size[N]); //FNV-1a hash of every status
+
+
+
+int main(int argc, char *argv[])
 {
+	if(argc > 1 && strcmp(argv[1], "verify") == 0){ //"verify [cases] [generations] [seed]" checks the fast engines and exits
+		uint cases = argc > 2 ? (uint)strtoul(argv[2], NULL, 10) : 100;
+		uint generations = argc > 3 ? (uint)strtoul(argv[3], NULL, 10) : 100;
+		uint seed = argc > 4 ? (uint)strtoul(argv[4], NULL, 10) : (uint)time(NULL);
+		return VerifyEngines(cases, generations, seed);
+	}
 
 	int grid = 0; //master grid control variable
+	int frames = 0; //frame export control variable
 	int breaker = 1;
 	int flag;
 	int option_main;
 
+	srand((unsigned)time(NULL)); //for randomised regions in edit scripts
+
 	while(breaker == 1){
 		printf("CONWAY'S GAME OF LIFE \nbut its in c\n\n\n");
 		printf("MAIN MENU\n");
 		printf("Option (0): Quit the game.\n");
 		printf("Option (1): Play the game.\n");
 		printf("Option (2): Toggle Grid Mode\n");
+		printf("Option (3): Toggle Viewport Mode\n");
+		printf("Option (4): Toggle Frame Export\n");
 		printf("Please enter the number that corresponds to your selection: ");
 		if((flag = scanf("%i", &option_main)) == 0){
 			option_main = 5;
@@ -87,10 +229,11 @@ int main()
 				breaker = 0;
 				break;
 			case 1:
-				PlayMenu(grid);
+				PlayMenu(grid, frames);
 				continue;
 			case 2:
-				if(grid == 0){
+				if(grid != 1){
+					if(grid == 2) printf("\nViewport Mode OFF"); //grid and viewport mode can't both be on
                     grid = 1;
 					printf("\nGrid Mode ON\n\n");
 					continue;
@@ -98,6 +241,29 @@ int main()
 				else grid = 0;
 				printf("\nGrid Mode OFF\n\n");
 				continue;
+			case 3:
+				if(grid != 2){
+					if(grid == 1) printf("\nGrid Mode OFF");
+					grid = 2;
+					printf("\nViewport Mode ON\n\n");
+					continue;
+				}
+				else grid = 0;
+				printf("\nViewport Mode OFF\n\n");
+				continue;
+			case 4:
+#ifdef FRAME_EXPORT
+				if(frames == 0){
+					frames = 1;
+					printf("\nFrame Export ON\n\n");
+					continue;
+				}
+				else frames = 0;
+				printf("\nFrame Export OFF\n\n");
+#else
+				printf("\nFrame export isn't available in this build\n\n");
+#endif
+				continue;
 			default:
 				printf("\nUnknown selection. Please try again\n");
 				continue;
@@ -122,26 +288,59 @@ board_cell **GenerateBoard(uint board_size[N]){ //calloc is used as it sets arra
 }
 
 //Updates the board every generation
-void Ticker(float delay, board_cell **Board, uint board_size[N], int End_Generation, int grid){
+void Ticker(float delay, board_cell **Board, uint board_size[N], int End_Generation, int grid, int frames){
 	int Gen = 1;
+	viewport view = {0, 0, 24, 80, 1, 0, 0};
+	uint **Density = NULL;
+	int *left = GenerateWrap(board_size, -1);
+	int *right = GenerateWrap(board_size, 1);
+	if(left == NULL || right == NULL){
+		free(left);
+		free(right);
+		return;
+	}
+	frame_exporter *Export = NULL;
+	if(frames == 1) Export = ExportMenu(board_size); //only asks when frame export has been toggled on
+	if(grid == 2){ //viewport mode keeps a density table up to date so zoomed out views don't rescan the board
+		ViewportMenu(&view, board_size);
+		Density = GenerateDensity(board_size);
+		if(Density == NULL){
+			if(Export != NULL) ExportClose(Export);
+			free(left);
+			free(right);
+			return;
+		}
+		DensityUpdate(Board, board_size, Density);
+	}
 	while(Gen < End_Generation + 1){
 		printf("\n Generation: [%i / %i]\n", Gen, End_Generation);
-		if(grid == 0){
-			PrintBoard(Board, board_size);
+		if(grid == 2){
+			PrintBoardViewport(Board, board_size, Density, &view);
+			ViewportPan(&view, board_size);
 		}
 		else{
-			PrintBoardGrid(Board, board_size);
+			DisplayBoard(Board, board_size, grid);
 		};
+		if(Export != NULL) ExportSubmit(Export, Board, Gen);
 		if(delay <= 0){
 			delay = 0.01;
 		}
 		
-		BoardScan(Board, board_size);
-		BoardUpdate(Board, board_size);
+		BoardScanFast(Board, board_size, left, right); //checked against BoardScan by running the program with "verify"
+		if(grid == 2){
+			BoardUpdateDensity(Board, board_size, Density);
+		}
+		else{
+			BoardUpdate(Board, board_size);
+		}
 		ClearNextGen(Board, board_size);
 		TimeControl(delay);
 		++Gen;
 	}
+	if(Density != NULL) FreeDensity(Density, board_size);
+	if(Export != NULL) ExportClose(Export);
+	free(left);
+	free(right);
 }
 
 //manages delay, using <time.h>
@@ -193,6 +392,22 @@ void PrintBoardGrid(board_cell **Board, uint board_size[N]){ //supports board si
 	}
 }
 
+//prints the board the way the current display mode asks for
+void DisplayBoard(board_cell **Board, uint board_size[N], int grid){
+	if(grid == 0){
+		PrintBoard(Board, board_size);
+	}
+	else if(grid == 1){
+		PrintBoardGrid(Board, board_size);
+	}
+	else{ //viewport mode outside of a run, show the top left corner unzoomed
+		viewport view = {0, 0, 24, 80, 1, 0, 0};
+		if(view.rows > board_size[0]) view.rows = board_size[0];
+		if(view.cols > board_size[1]) view.cols = board_size[1];
+		PrintBoardViewport(Board, board_size, NULL, &view);
+	}
+}
+
 //handles rule set of Life from https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life
 void BoardScan(board_cell **Board, uint board_size[N]){
 	for(int i=0; i<board_size[0]; ++i){
@@ -209,6 +424,42 @@ void BoardScan(board_cell **Board, uint board_size[N]){
 	return;
 }
 
+//wrapped column q steps away from every column, so BoardScanFast doesn't call jadd for every neighbour
+int *GenerateWrap(uint board_size[N], int q){
+	int *wrap = (int *)malloc(board_size[1] * sizeof(int));
+	if(wrap == NULL){
+		printf("\nERROR! MEMORY ALLOCATION FAILED!\n");
+		return NULL;
+	}
+	for(int j=0; j<board_size[1]; ++j){
+		wrap[j] = jadd(j, q, board_size);
+	}
+	return wrap;
+}
+
+//same rules as BoardScan, but the wrapped neighbour rows are found once per row and the columns come from GenerateWrap tables
+void BoardScanFast(board_cell **Board, uint board_size[N], int *left, int *right){
+	for(int i=0; i<board_size[0]; ++i){
+		board_cell *up = Board[iadd(i, -1, board_size)];
+		board_cell *row = Board[i];
+		board_cell *down = Board[iadd(i, 1, board_size)];
+		for(int j=0; j<board_size[1]; ++j){
+			int l = left[j];
+			int r = right[j];
+			int count = (up[l].status == 1) + (up[j].status == 1) + (up[r].status == 1)
+				+ (row[l].status == 1) + (row[r].status == 1)
+				+ (down[l].status == 1) + (down[j].status == 1) + (down[r].status == 1);
+
+			if(count == 2)row[j].next_gen = row[j].status; //stagnation, stasis
+			if(count == 3)row[j].next_gen = 1; //reproduction, life
+			if(count > 3)row[j].next_gen = 0; //overpopulation, death
+			if(count < 2)row[j].next_gen = 0; //underpopulation, death
+
+			}//end of j loop
+		}//end of i loop
+	return;
+}
+
 //commits result of board scan to board
 void BoardUpdate(board_cell **Board, uint board_size[N]){
 	for(int i=0; i<board_size[0]; ++i){
@@ -259,6 +510,347 @@ int neighbour(int i, int j, board_cell **Board, uint board_size[N]){
 	return sum;
 }
 
+/*		Viewport functions		*/
+//allocates the summed-area table, Density[i][j] holds the number of live cells above and left of cell (i, j)
+uint **GenerateDensity(uint board_size[N]){ //one extra row and column of zeros so block counts need no edge checks
+	uint **Density = (uint **)calloc(board_size[0] + 1, sizeof(uint *));
+	if(Density == NULL){
+		printf("\nERROR! MEMORY ALLOCATION FAILED!\n");
+		return NULL;
+	}
+	for(uint i = 0; i < board_size[0] + 1; ++i)
+		Density[i] = (uint *)calloc(board_size[1] + 1, sizeof(uint));
+	return Density;
+}
+
+//frees the summed-area table
+void FreeDensity(uint **Density, uint board_size[N]){
+	for(uint F=0; F<board_size[0] + 1; F++){
+		free(Density[F]);
+	}
+	free(Density);
+}
+
+//rebuilds the summed-area table from the current status of every cell
+void DensityUpdate(board_cell **Board, uint board_size[N], uint **Density){
+	for(uint i=0; i<board_size[0]; ++i){
+		uint row_sum = 0;
+		for(uint j=0; j<board_size[1]; ++j){
+			row_sum += Board[i][j].status;
+			Density[i+1][j+1] = Density[i][j+1] + row_sum;
+		}//end of j loop
+	}//end of i loop
+}
+
+//BoardUpdate and DensityUpdate in a single pass over the board, so viewport mode costs no extra scan per generation
+void BoardUpdateDensity(board_cell **Board, uint board_size[N], uint **Density){
+	for(uint i=0; i<board_size[0]; ++i){
+		uint row_sum = 0;
+		for(uint j=0; j<board_size[1]; ++j){
+			Board[i][j].status = Board[i][j].next_gen;
+			row_sum += Board[i][j].status;
+			Density[i+1][j+1] = Density[i][j+1] + row_sum;
+		}//end of j loop
+	}//end of i loop
+}
+
+//number of live cells in the h x w block starting at (i, j), blocks running off the edge loop around like the board does
+uint DensityCount(uint **Density, uint board_size[N], uint i, uint j, uint h, uint w){
+	if(i + h > board_size[0]){ //split into the part above the bottom edge and the part wrapped to the top
+		return DensityCount(Density, board_size, i, j, board_size[0] - i, w)
+			+ DensityCount(Density, board_size, 0, j, i + h - board_size[0], w);
+	}
+	if(j + w > board_size[1]){ //same again for the right edge
+		return DensityCount(Density, board_size, i, j, h, board_size[1] - j)
+			+ DensityCount(Density, board_size, i, 0, h, j + w - board_size[1]);
+	}
+	return Density[i+h][j+w] - Density[i][j+w] - Density[i+h][j] + Density[i][j];
+}
+
+//prints only the window of the board described by view, each character shows how full its block of cells is
+void PrintBoardViewport(board_cell **Board, uint board_size[N], uint **Density, viewport *view){
+	static const char glyphs[] = " .:-=+*#%@"; //empty to full
+	uint zoom = view->zoom;
+	uint h = zoom < board_size[0] ? zoom : board_size[0]; //a block can't be bigger than the board itself
+	uint w = zoom < board_size[1] ? zoom : board_size[1];
+	uint area = h * w;
+	char *line = (char *)malloc(view->cols + 2);
+	if(line == NULL){
+		printf("\nERROR! MEMORY ALLOCATION FAILED!\n");
+		return;
+	}
+
+	printf("\n[view %u,%u zoom %u]\n", view->top, view->left, zoom);
+	for(uint r=0; r<view->rows; ++r){
+		uint i = (uint)iadd(view->top, (r * zoom) % board_size[0], board_size);
+		for(uint c=0; c<view->cols; ++c){
+			uint j = (uint)jadd(view->left, (c * zoom) % board_size[1], board_size);
+			uint count;
+			if(zoom == 1 || Density == NULL) count = Board[i][j].status; //unzoomed, the cell is its own block
+			else count = DensityCount(Density, board_size, i, j, h, w);
+			line[c] = glyphs[(count * 9 + area - 1) / area]; //rounds up, so a single live cell still shows
+		}//end of c loop
+		line[view->cols] = '\n';
+		line[view->cols + 1] = '\0';
+		fputs(line, stdout);
+	}//end of r loop
+	free(line);
+}
+
+//moves the view along by its pan step, wrapping around the board
+void ViewportPan(viewport *view, uint board_size[N]){
+	view->top = (uint)iadd(view->top, view->pan_i % (int)board_size[0], board_size);
+	view->left = (uint)jadd(view->left, view->pan_j % (int)board_size[1], board_size);
+}
+
+#ifdef FRAME_EXPORT
+/*		Frame export functions
+	Ticker hands each exported generation over as a copy of the board. Encoding and writing happen on EXPORT_WORKERS threads.
+	Frames are written out in generation order.
+*/
+frame_exporter *ExportOpen(int format, uint scale, uint stride, const char *command, uint board_size[N]){
+	frame_exporter *Export = (frame_exporter *)calloc(1, sizeof(frame_exporter));
+	if(Export == NULL){
+		printf("\nERROR! MEMORY ALLOCATION FAILED!\n");
+		return NULL;
+	}
+	Export->format = format;
+	Export->scale = scale == 0 ? 1 : scale;
+	Export->stride = stride == 0 ? 1 : stride;
+	Export->board_size[0] = board_size[0];
+	Export->board_size[1] = board_size[1];
+	size_t out = ExportFrameBytes(board_size, Export->scale);
+	if(out == 0){
+		printf("\nERROR! FRAMES THAT SIZE ARE TOO BIG TO EXPORT!\n");
+		free(Export);
+		return NULL;
+	}
+	Export->width = board_size[1] * Export->scale; //fits, ExportFrameBytes checked it
+	Export->height = board_size[0] * Export->scale;
+
+	size_t cells = (size_t)board_size[0] * board_size[1];
+	for(int k=0; k<EXPORT_SLOTS; ++k){
+		Export->slots[k].cells = (unsigned char *)malloc(cells);
+		Export->slots[k].out = (unsigned char *)malloc(out);
+		if(Export->slots[k].cells == NULL || Export->slots[k].out == NULL){
+			printf("\nERROR! MEMORY ALLOCATION FAILED!\n");
+			for(int F=0; F<=k; ++F){
+				free(Export->slots[F].cells);
+				free(Export->slots[F].out);
+			}
+			free(Export);
+			return NULL;
+		}
+	}
+	if(format == 3){
+		Export->stream = popen(command, "w");
+		if(Export->stream == NULL){
+			printf("Error starting %s!\n", command);
+			for(int F=0; F<EXPORT_SLOTS; ++F){
+				free(Export->slots[F].cells);
+				free(Export->slots[F].out);
+			}
+			free(Export);
+			return NULL;
+		}
+		Export->old_sigpipe = signal(SIGPIPE, SIG_IGN); //writes to a dead command fail instead of killing the game
+	}
+
+	pthread_mutex_init(&Export->lock, NULL);
+	pthread_cond_init(&Export->changed, NULL);
+	for(int k=0; k<EXPORT_WORKERS; ++k){
+		if(pthread_create(&Export->workers[Export->worker_count], NULL, ExportWorker, Export) == 0) ++Export->worker_count;
+	}
+	if(Export->worker_count == 0){
+		printf("Error starting the frame export threads!\n");
+		if(Export->stream != NULL){
+			pclose(Export->stream);
+			signal(SIGPIPE, Export->old_sigpipe);
+		}
+		pthread_mutex_destroy(&Export->lock);
+		pthread_cond_destroy(&Export->changed);
+		for(int F=0; F<EXPORT_SLOTS; ++F){
+			free(Export->slots[F].cells);
+			free(Export->slots[F].out);
+		}
+		free(Export);
+		return NULL;
+	}
+	return Export;
+}
+
+//copies the board into the next free slot, the game only waits here when the workers are EXPORT_SLOTS frames behind
+void ExportSubmit(frame_exporter *Export, board_cell **Board, uint gen){
+	if((gen - 1) % Export->stride != 0) return;
+
+	pthread_mutex_lock(&Export->lock);
+	export_frame *Frame = &Export->slots[Export->next_submit % EXPORT_SLOTS];
+	while(Frame->state != 0 && Export->failed == 0) pthread_cond_wait(&Export->changed, &Export->lock);
+	if(Export->failed == 1){ //export already stopped, the game carries on without it
+		pthread_mutex_unlock(&Export->lock);
+		return;
+	}
+	pthread_mutex_unlock(&Export->lock);
+
+	//the slot is free, so no worker touches it until it is handed over below
+	unsigned char *cell = Frame->cells;
+	for(uint i=0; i<Export->board_size[0]; ++i){
+		for(uint j=0; j<Export->board_size[1]; ++j){
+			*cell++ = (unsigned char)Board[i][j].status;
+		}//j loop
+	}//i loop
+	Frame->gen = gen;
+
+	pthread_mutex_lock(&Export->lock);
+	Frame->state = 1;
+	++Export->next_submit;
+	pthread_cond_broadcast(&Export->changed);
+	pthread_mutex_unlock(&Export->lock);
+}
+
+//waits for the workers to finish every queued frame, then frees everything
+void ExportClose(frame_exporter *Export){
+	pthread_mutex_lock(&Export->lock);
+	Export->stopping = 1;
+	pthread_cond_broadcast(&Export->changed);
+	pthread_mutex_unlock(&Export->lock);
+	for(int k=0; k<Export->worker_count; ++k){
+		pthread_join(Export->workers[k], NULL);
+	}
+
+	if(Export->stream != NULL){
+		int status = pclose(Export->stream);
+		if(status == -1) printf("\nError closing the frame export command\n");
+		else if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) printf("\nThe frame export command failed (exit code %i)\n", WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+		signal(SIGPIPE, Export->old_sigpipe);
+	}
+	if(Export->failed == 1) printf("\nFrame export stopped early, %u frames exported\n", Export->next_write);
+	else printf("\n%u frames exported\n", Export->next_write);
+	pthread_mutex_destroy(&Export->lock);
+	pthread_cond_destroy(&Export->changed);
+	for(int F=0; F<EXPORT_SLOTS; ++F){
+		free(Export->slots[F].cells);
+		free(Export->slots[F].out);
+	}
+	free(Export);
+}
+
+//takes queued frames in order and encodes them. Whichever worker finds the oldest frame encoded writes out as many as are ready
+void *ExportWorker(void *arg){
+	frame_exporter *Export = (frame_exporter *)arg;
+	pthread_mutex_lock(&Export->lock);
+	while(1){
+		while(Export->stopping == 0 && Export->next_encode == Export->next_submit){
+			pthread_cond_wait(&Export->changed, &Export->lock);
+		}
+		if(Export->next_encode == Export->next_submit) break; //stopping and nothing left to encode
+
+		export_frame *Frame = &Export->slots[Export->next_encode % EXPORT_SLOTS];
+		++Export->next_encode;
+		pthread_mutex_unlock(&Export->lock);
+		ExportEncode(Export, Frame);
+		pthread_mutex_lock(&Export->lock);
+		Frame->state = 2;
+
+		while(Export->writing == 0 && Export->next_write < Export->next_encode
+			&& Export->slots[Export->next_write % EXPORT_SLOTS].state == 2){
+			export_frame *Ready = &Export->slots[Export->next_write % EXPORT_SLOTS];
+			int skip = Export->failed; //once a write has failed the rest are dropped, but their slots still get freed
+			Export->writing = 1;
+			pthread_mutex_unlock(&Export->lock);
+			int result = skip == 1 ? 0 : ExportWrite(Export, Ready);
+			pthread_mutex_lock(&Export->lock);
+			Export->writing = 0;
+			Ready->state = 0;
+			if(result != 0) Export->failed = 1;
+			if(skip == 0 && result == 0) ++Export->next_write;
+			pthread_cond_broadcast(&Export->changed);
+		}
+	}
+	pthread_mutex_unlock(&Export->lock);
+	return NULL;
+}
+
+size_t ExportFrameBytes(uint board_size[N], uint scale){
+	unsigned long long width = (unsigned long long)board_size[1] * scale;
+	unsigned long long height = (unsigned long long)board_size[0] * scale;
+	if(width > UINT_MAX || height > UINT_MAX) return 0;
+	if(height != 0 && width > (SIZE_MAX - 64) / height) return 0;
+	return (size_t)width * height + 64; //8 bit pixels plus room for a header, PBM needs less
+}
+
+//turns a frame's cells into an image, every cell becomes a scale x scale square and live cells are black
+void ExportEncode(frame_exporter *Export, export_frame *Frame){
+	uint scale = Export->scale;
+	unsigned char *out = Frame->out;
+	unsigned char *cell = Frame->cells;
+	size_t n = 0;
+
+	if(Export->format == 1){ //PBM, 8 pixels to a byte, 1 is black
+		size_t row_bytes = ((size_t)Export->width + 7) / 8;
+		n = (size_t)sprintf((char *)out, "P4\n%u %u\n", Export->width, Export->height);
+		for(uint i=0; i<Export->board_size[0]; ++i, cell += Export->board_size[1]){
+			unsigned char *row = out + n;
+			memset(row, 0, row_bytes);
+			for(uint j=0; j<Export->board_size[1]; ++j){
+				if(cell[j] != 1) continue;
+				for(uint x=j*scale; x<(j+1)*scale; ++x) row[x / 8] |= (unsigned char)(0x80 >> (x % 8));
+			}//j loop
+			n += row_bytes;
+			for(uint k=1; k<scale; ++k, n += row_bytes) memcpy(out + n, row, row_bytes); //repeat the pixel row for the rest of the square
+		}//i loop
+	}
+	else{ //PGM or raw, one byte a pixel
+		if(Export->format == 2) n = (size_t)sprintf((char *)out, "P5\n%u %u\n255\n", Export->width, Export->height);
+		for(uint i=0; i<Export->board_size[0]; ++i, cell += Export->board_size[1]){
+			unsigned char *row = out + n;
+			for(uint j=0; j<Export->board_size[1]; ++j){
+				memset(row + (size_t)j * scale, cell[j] == 1 ? 0 : 255, scale);
+			}//j loop
+			n += Export->width;
+			for(uint k=1; k<scale; ++k, n += Export->width) memcpy(out + n, row, Export->width);
+		}//i loop
+	}
+	Frame->out_size = n;
+}
+
+//writes an encoded frame to its own frame_GENERATION.pbm/.pgm file in the root directory, or down the pipe
+int ExportWrite(frame_exporter *Export, export_frame *Frame){
+	if(Export->format == 3){
+		//flushed every frame so a command that has exited is noticed straight away, not a buffer later
+		if(fwrite(Frame->out, 1, Frame->out_size, Export->stream) != Frame->out_size || fflush(Export->stream) != 0){
+			printf("\nError writing frame %u to the export command, frame export stopped\n", Frame->gen);
+			return -1;
+		}
+		return 0;
+	}
+	char name[SMAX];
+	snprintf(name, SMAX, "frame_%06u.%s", Frame->gen, Export->format == 1 ? "pbm" : "pgm");
+	FILE *O;
+	O = fopen(name, "wb");
+	if(O == NULL){
+		printf("\nError writing %s, frame export stopped\n", name);
+		return -1;
+	}
+	size_t written = fwrite(Frame->out, 1, Frame->out_size, O);
+	if(fclose(O) != 0 || written != Frame->out_size){
+		printf("\nError writing %s, frame export stopped\n", name);
+		return -1;
+	}
+	return 0;
+}
+
+#else
+//frame export isn't built, Ticker never gets an exporter so these are never reached
+void ExportSubmit(frame_exporter *Export, board_cell **Board, uint gen){
+	return;
+}
+
+void ExportClose(frame_exporter *Export){
+	return;
+}
+#endif
+
 //count cols of load.txt by counting \n new line buffers
 int FileCountCols(){
 	FILE *F;
@@ -306,7 +898,7 @@ void SaveMenu(board_cell **Board, uint board_size[N]){
 }
 
 //loads a board and then runs board
-void LoadMenu(int grid){
+void LoadMenu(int grid, int frames){
 	int flag;
 	uint board_size[N];
 	printf("\nLoading a custom game...\n");
@@ -328,12 +920,7 @@ void LoadMenu(int grid){
 	board_cell **Board = NULL; //pointer initialisation
 	Board = GenerateBoard(board_size);
 	FileLoad(Board, board_size);
-	if(grid == 0){
-		PrintBoard(Board, board_size);
-	}
-	else{
-		PrintBoardGrid(Board, board_size);
-	}
+	DisplayBoard(Board, board_size, grid);
 	printf("\nHow many generations to play the board for?");
 	int End_Generation;
 	if((flag = scanf("%i", &End_Generation)) != 1) return;
@@ -344,14 +931,75 @@ void LoadMenu(int grid){
 	if(delay <= 0) delay = 0.01; //prevents crashes due to how clock_t works
 
 	printf("\n\nLOADING THE BOARD\n\n");
-	Ticker(delay, Board, board_size, End_Generation, grid);
+	Ticker(delay, Board, board_size, End_Generation, grid, frames);
 	FreeMemory(Board, board_size);
 	return;
 
 }
 
+//asks for the window, zoom and panning to use for a run in viewport mode
+void ViewportMenu(viewport *view, uint board_size[N]){
+	int flag;
+	printf("\nViewport top row and left column: ");
+	if((flag = scanf("%u %u", &view->top, &view->left)) != 2){
+		view->top = 0;
+		view->left = 0;
+	}
+	printf("Viewport height and width in characters: ");
+	if((flag = scanf("%u %u", &view->rows, &view->cols)) != 2){
+		view->rows = 24;
+		view->cols = 80;
+	}
+	printf("Zoom level (cells per character side, 1 for no zoom): ");
+	if((flag = scanf("%u", &view->zoom)) != 1) view->zoom = 1;
+	printf("Rows and columns to pan by each generation (0 0 for a fixed view): ");
+	if((flag = scanf("%i %i", &view->pan_i, &view->pan_j)) != 2){
+		view->pan_i = 0;
+		view->pan_j = 0;
+	}
+
+	if(view->zoom == 0) view->zoom = 1;
+	view->top %= board_size[0];
+	view->left %= board_size[1];
+	//no point showing more characters than it takes to cover the board once
+	if(view->rows == 0 || view->rows > (board_size[0] + view->zoom - 1) / view->zoom)
+		view->rows = (board_size[0] + view->zoom - 1) / view->zoom;
+	if(view->cols == 0 || view->cols > (board_size[1] + view->zoom - 1) / view->zoom)
+		view->cols = (board_size[1] + view->zoom - 1) / view->zoom;
+}
+
+#ifdef FRAME_EXPORT
+//asks whether to export the run's generations as images or a raw stream, NULL if not
+frame_exporter *ExportMenu(uint board_size[N]){
+	int flag;
+	int format;
+	uint scale, stride;
+	char command[SMAX] = "";
+	printf("\nExport frames? 0 for no, 1 for PBM images, 2 for PGM images, 3 to pipe raw frames to a command : ");
+	if((flag = scanf("%i", &format)) != 1 || format < 1 || format > 3) return NULL;
+	printf("Pixels per cell: ");
+	if((flag = scanf("%u", &scale)) != 1 || scale == 0) scale = 1;
+	if(ExportFrameBytes(board_size, scale) == 0){
+		printf("\nERROR! FRAMES THAT SIZE ARE TOO BIG TO EXPORT!\n");
+		return NULL;
+	}
+	printf("Export every how many generations? (1 for all of them): ");
+	if((flag = scanf("%u", &stride)) != 1 || stride == 0) stride = 1;
+	if(format == 3){
+		printf("Frames are %u x %u pixels, 8 bit grey. Command to pipe them to: ", board_size[1] * scale, board_size[0] * scale); //fits, checked above
+		if((flag = scanf(" %255[^\n]", command)) != 1) return NULL; //rest of the line, e.g. an ffmpeg command line
+	}
+	return ExportOpen(format, scale, stride, command, board_size);
+}
+#else
+//frame export isn't built
+frame_exporter *ExportMenu(uint board_size[N]){
+	return NULL;
+}
+#endif
+
 //menu for what to play
-void PlayMenu(int grid){
+void PlayMenu(int grid, int frames){
 	int flag;
 	int option_play;
 	int breaker_play = 1;
@@ -371,15 +1019,15 @@ void PlayMenu(int grid){
 				break;
 
 			case 1: //custom game from within console
-				CustomPlay(grid);
+				CustomPlay(grid, frames);
 				continue;
 
 			case 2: //predefined boards
-				PreDefBoardMenu(grid);
+				PreDefBoardMenu(grid, frames);
 				continue;
 
 			case 3: //file load
-				LoadMenu(grid);
+				LoadMenu(grid, frames);
 				continue;
 			
 			default:
@@ -391,7 +1039,7 @@ void PlayMenu(int grid){
 
 
 //create new board from scratch
-void CustomPlay(int grid){
+void CustomPlay(int grid, int frames){
 	int flag;
 	uint board_size[N]={1,1};
 	printf("\nCreating a custom game...\n");
@@ -411,17 +1059,13 @@ void CustomPlay(int grid){
 	}
 	board_cell **Board = NULL; //pointer initialisation
 	Board = GenerateBoard(board_size);
-	if(grid == 0){
-		PrintBoard(Board, board_size);
-	}
-	else{
-		PrintBoardGrid(Board, board_size);
-	}
+	DisplayBoard(Board, board_size, grid);
 
 	int customise_control = 1;
-	while(customise_control == 1){
-		CustomiseBoard(Board, board_size, grid);
-		printf("Keep editing cells? 1 for yes, 0 for no : ");
+	while(customise_control == 1 || customise_control == 2){
+		if(customise_control == 2) ScriptMenu(Board, board_size, grid);
+		else CustomiseBoard(Board, board_size, grid);
+		printf("Keep editing cells? 1 for yes, 2 to run edit.txt, 0 for no : ");
 		scanf("%i", &customise_control);
 	}
 
@@ -437,14 +1081,14 @@ void CustomPlay(int grid){
 	SaveMenu(Board, board_size);
 
 	printf("\n\nLOADING THE BOARD\n\n");
-	Ticker(delay, Board, board_size, End_Generation, grid);
+	Ticker(delay, Board, board_size, End_Generation, grid, frames);
 	FreeMemory(Board, board_size);
 	return;
 
 }
 
 /*		Menu for pre-defined boards	*/
-void PreDefBoardMenu(int grid){
+void PreDefBoardMenu(int grid, int frames){
 	int flag;
 	int option_predef;
 	int breaker_predef = 1;
@@ -467,21 +1111,17 @@ void PreDefBoardMenu(int grid){
 				breaker_predef = 0;
 				break;
 			case 1: //predefined board setup
-				BoardOscillatorLoad(Board);
+				BoardOscillatorLoad(Board, board_size, 0, 0);
 				BoardUpdate(Board, board_size);
-				if(grid == 0){
-					PrintBoard(Board, board_size);
-				}
-				else{
-					PrintBoardGrid(Board, board_size);
-				}
-				printf("Would you like to customise the board before playing?\nEnter 1 for yes, 0 for no. : ");
+				DisplayBoard(Board, board_size, grid);
+				printf("Would you like to customise the board before playing?\nEnter 1 for yes, 2 to run the edit script in edit.txt, 0 for no. : ");
 				int predef_blinker_control;
 				if((flag = scanf("%i", &predef_blinker_control)) == 0) return;
 				printf("\n");
-				while(predef_blinker_control == 1){
-					CustomiseBoard(Board, board_size, grid);
-					printf("Keep editing cells? 1 for yes, 0 for no : ");
+				while(predef_blinker_control == 1 || predef_blinker_control == 2){
+					if(predef_blinker_control == 2) ScriptMenu(Board, board_size, grid);
+					else CustomiseBoard(Board, board_size, grid);
+					printf("Keep editing cells? 1 for yes, 2 to run edit.txt, 0 for no : ");
 					scanf("%i", &predef_blinker_control);
 				}
 
@@ -497,27 +1137,23 @@ void PreDefBoardMenu(int grid){
 				if((flag = scanf("%f", &delay)) != 1) return;
 				if(delay == 0) delay = 0.01;
 				printf("\n\nLOADING THE BOARD\n\n");
-				Ticker(delay, Board, board_size, End_Generation, grid);
+				Ticker(delay, Board, board_size, End_Generation, grid, frames);
 				FreeMemory(Board, board_size);
 				continue;
 
 
 			case 2://spaceship board setup
-				BoardSpaceshipLoad(Board);
+				BoardSpaceshipLoad(Board, board_size, 0, 0);
 				BoardUpdate(Board, board_size);
-				if(grid == 0){
-					PrintBoard(Board, board_size);
-				}
-				else{
-					PrintBoardGrid(Board, board_size);
-				}
-				printf("Would you like to customise the board before playing?\nEnter 1 for yes, 0 for no. : ");
+				DisplayBoard(Board, board_size, grid);
+				printf("Would you like to customise the board before playing?\nEnter 1 for yes, 2 to run the edit script in edit.txt, 0 for no. : ");
 				int predef_space_control;
 				if((flag = scanf("%i", &predef_space_control)) == 0) return;
 				printf("\n");
-				while(predef_space_control == 1){
-					CustomiseBoard(Board, board_size, grid);
-					printf("Keep editing cells? 1 for yes, 0 for no : ");
+				while(predef_space_control == 1 || predef_space_control == 2){
+					if(predef_space_control == 2) ScriptMenu(Board, board_size, grid);
+					else CustomiseBoard(Board, board_size, grid);
+					printf("Keep editing cells? 1 for yes, 2 to run edit.txt, 0 for no : ");
 					scanf("%i", &predef_space_control);
 				}
 
@@ -533,7 +1169,7 @@ void PreDefBoardMenu(int grid){
 				if(delay <= 0) delay = 0.01;
 
 				printf("\n\nLOADING THE BOARD\n\n");
-				Ticker(delay, Board, board_size, End_Generation, grid);
+				Ticker(delay, Board, board_size, End_Generation, grid, frames);
 				FreeMemory(Board, board_size);
 				continue;
 
@@ -576,10 +1212,19 @@ void CustomiseBoard(board_cell **Board, uint board_size[N], int grid){
 	if(Board[k][l].status == 1) Board[k][l].next_gen = 0;
 	if(Board[k][l].status == 0) Board[k][l].next_gen = 1;
 	BoardUpdate(Board, board_size);
-	if(grid == 0){
-		PrintBoard(Board, board_size);
-		}
-	else PrintBoardGrid(Board, board_size);
+	DisplayBoard(Board, board_size, grid);
+	return;
+}
+
+//runs the edit script in edit.txt over the board and prints the board once at the end
+void ScriptMenu(board_cell **Board, uint board_size[N], int grid){
+	printf("\nRunning edit script edit.txt...\n");
+	clock_t start_time = clock();
+	int applied = ScriptApply(Board, board_size, "edit.txt");
+	if(applied < 0) return;
+	double taken = (double)(clock() - start_time) / CLOCKS_PER_SEC;
+	DisplayBoard(Board, board_size, grid);
+	printf("\n%i edit commands applied in %.3f seconds\n", applied, taken);
 	return;
 }
 
@@ -616,160 +1261,592 @@ void FileSave(board_cell **Board, uint board_size[N]){
 	return;
 }
 
+/*		Edit script functions		*/
+/*	Script format, one command per line, i is the row and j the column as in Board[i][j]. Lines starting with # are comments.
+		set i j / clear i j / toggle i j		change one cell
+		fill i j h w set|clear|toggle			change every cell of an h x w rectangle
+		random i j h w density					set an h x w rectangle randomly, density between 0 and 1
+		stamp i j name [r]						stamp a library pattern turned r quarter turns clockwise, a built in board
+												(oscillators, spaceships) or an .rle file
+	Every command's i j has to be on the board, rectangles and stamps are then cut off at the edge of it.
+	Lines can be up to SMAX - 2 characters long. Nothing is printed until the whole script has run.
+*/
+int ScriptApply(board_cell **Board, uint board_size[N], const char *filename){
+	FILE *F;
+	F = fopen(filename, "r");
+	if(F == NULL){
+		printf("Error accessing file!\n");
+		return -1;
+	}
+
+	char line[SMAX];
+	char word[SMAX];
+	int applied = 0;
+	int line_no = 0;
+	uint num[4]; //i, j, h, w
+	float density;
+
+	while(fgets(line, SMAX, F) != NULL){
+		++line_no;
+		if(strchr(line, '\n') == NULL && !feof(F)){ //line didn't fit, skip the rest of it rather than read it as another command
+			int c;
+			while((c = getc(F)) != EOF && c != '\n');
+			printf("%s line %i: line is too long, the most is %i characters\n", filename, line_no, SMAX - 2);
+			continue;
+		}
+		char *rest = line;
+		while(*rest == ' ' || *rest == '\t') ++rest;
+		char *command = rest;
+		while(*rest != '\0' && *rest != ' ' && *rest != '\t' && *rest != '\n' && *rest != '\r') ++rest;
+		if(rest == command || command[0] == '#') continue; //blank line or comment
+		if(*rest != '\0') *rest++ = '\0';
+
+		int done = 0;
+		int mode = -1;
+		if(strcmp(command, "clear") == 0) mode = 0;
+		if(strcmp(command, "set") == 0) mode = 1;
+		if(strcmp(command, "toggle") == 0) mode = 2;
+
+		if(mode >= 0){
+			if(ScriptNumbers(&rest, num, 2) == 2 && num[0] < board_size[0] && num[1] < board_size[1]){
+				ScriptCell(Board, num[0], num[1], mode);
+				done = 1;
+			}
+		}
+		else if(strcmp(command, "fill") == 0){
+			if(ScriptNumbers(&rest, num, 4) == 4 && num[0] < board_size[0] && num[1] < board_size[1] && sscanf(rest, "%255s", word) == 1){
+				if(strcmp(word, "clear") == 0) mode = 0;
+				if(strcmp(word, "set") == 0) mode = 1;
+				if(strcmp(word, "toggle") == 0) mode = 2;
+				if(mode >= 0){
+					ScriptFill(Board, board_size, num[0], num[1], num[2], num[3], mode);
+					done = 1;
+				}
+			}
+		}
+		else if(strcmp(command, "random") == 0){
+			if(ScriptNumbers(&rest, num, 4) == 4 && num[0] < board_size[0] && num[1] < board_size[1] && sscanf(rest, "%f", &density) == 1){
+				ScriptRandom(Board, board_size, num[0], num[1], num[2], num[3], density);
+				done = 1;
+			}
+		}
+		else if(strcmp(command, "stamp") == 0){
+			int used = 0;
+			if(ScriptNumbers(&rest, num, 2) == 2 && num[0] < board_size[0] && num[1] < board_size[1] && sscanf(rest, "%255s%n", word, &used) == 1){
+				rest += used;
+				if(ScriptNumbers(&rest, &num[2], 1) != 1) num[2] = 0; //rotation is optional
+				if(LibraryStamp(Board, board_size, word, num[0], num[1], (int)(num[2] % 4)) == 0) done = 1;
+				else if(RLEStamp(Board, board_size, word, num[0], num[1]) == 0) done = 1;
+			}
+		}
+
+		if(done == 1) ++applied;
+		else printf("%s line %i: could not apply command %s\n", filename, line_no, command);
+	}
+	fclose(F);
+	return applied;
+}
+
+//reads whole numbers off the front of a script line, moving text past them. Faster than sscanf for scripts with millions of lines
+int ScriptNumbers(char **text, uint *numbers, int count){
+	char *end;
+	for(int k=0; k<count; ++k){
+		while(**text == ' ' || **text == '\t') ++*text;
+		if(**text < '0' || **text > '9') return k; //also rejects negative numbers
+		numbers[k] = (uint)strtoul(*text, &end, 10);
+		*text = end;
+	}
+	return count;
+}
+
+//changes a single cell, next_gen is kept in step with status so a later BoardUpdate doesn't undo the edit
+void ScriptCell(board_cell **Board, uint i, uint j, int mode){
+	int value = mode;
+	if(mode == 2) value = !Board[i][j].status;
+	Board[i][j].status = value;
+	Board[i][j].next_gen = value;
+}
+
+//changes every cell in a rectangle, cut off at the edge of the board
+void ScriptFill(board_cell **Board, uint board_size[N], uint i, uint j, uint h, uint w, int mode){
+	if(i >= board_size[0] || j >= board_size[1]) return;
+	if(h > board_size[0] - i) h = board_size[0] - i;
+	if(w > board_size[1] - j) w = board_size[1] - j;
+	for(uint p=i; p<i+h; ++p){
+		for(uint q=j; q<j+w; ++q){
+			ScriptCell(Board, p, q, mode);
+		}//q loop
+	}//p loop
+}
+
+//sets every cell in a rectangle alive with probability density, cut off at the edge of the board
+void ScriptRandom(board_cell **Board, uint board_size[N], uint i, uint j, uint h, uint w, float density){
+	double threshold = density * ((double)RAND_MAX + 1.0); //density 0 never passes, density 1 always does
+	if(i >= board_size[0] || j >= board_size[1]) return;
+	if(h > board_size[0] - i) h = board_size[0] - i;
+	if(w > board_size[1] - j) w = board_size[1] - j;
+	for(uint p=i; p<i+h; ++p){
+		for(uint q=j; q<j+w; ++q){
+			ScriptCell(Board, p, q, (double)rand() < threshold);
+		}//q loop
+	}//p loop
+}
+
+//stamps the live cells of a run length encoded pattern file with its top left corner at (i0, j0)
+//format from https://conwaylife.com/wiki/Run_Length_Encoded
+int RLEStamp(board_cell **Board, uint board_size[N], const char *filename, uint i0, uint j0){
+	FILE *F;
+	F = fopen(filename, "r");
+	if(F == NULL) return -1;
+
+	uint i = i0;
+	uint j = j0;
+	uint run = 0;
+	int line_start = 1;
+	int c;
+	while(i < board_size[0] && (c = getc(F)) != EOF && c != '!'){ //! marks the end of the pattern, nothing below the board can land
+		if(c == '\n' || c == '\r'){
+			line_start = 1;
+			continue;
+		}
+		if(line_start == 1 && (c == '#' || c == 'x')){ //comment or "x = .., y = .." header line, skip it
+			while((c = getc(F)) != EOF && c != '\n');
+			continue;
+		}
+		line_start = 0;
+		if(c == ' ' || c == '\t') continue;
+		if(c >= '0' && c <= '9'){
+			if(run <= board_size[0] + board_size[1]) run = run * 10 + (c - '0'); //any longer run reaches past the board anyway
+			continue;
+		}
+		if(run == 0) run = 1;
+		if(c == '$'){ //end of row(s)
+			i = run < board_size[0] - i ? i + run : board_size[0];
+			j = j0;
+			run = 0;
+			continue;
+		}
+		if(j < board_size[1] && run > board_size[1] - j) run = board_size[1] - j; //clamp to the cells left on this row
+		if(c == 'o' || (c >= 'A' && c <= 'Z')){ //live cells
+			for(uint k=0; k<run && j < board_size[1]; ++k, ++j) ScriptCell(Board, i, j, 1);
+		}
+		else if(j < board_size[1]) j += run; //b and anything else are dead cells
+		run = 0;
+	}
+	fclose(F);
+	return 0;
+}
+
+//stamps a library pattern or one of the built in boards with its top left corner at (i0, j0)
+int LibraryStamp(board_cell **Board, uint board_size[N], const char *name, uint i0, uint j0, int rotation){
+	const pattern *pat = PatternFind(name);
+	if(pat != NULL){
+		PatternStamp(Board, board_size, pat, i0, j0, rotation);
+		return 0;
+	}
+	if(strcmp(name, "oscillators") == 0){
+		BoardOscillatorLoad(Board, board_size, i0, j0);
+		return 0;
+	}
+	if(strcmp(name, "spaceships") == 0){
+		BoardSpaceshipLoad(Board, board_size, i0, j0);
+		return 0;
+	}
+	return -1;
+}
+
 /*Pre-defined board functions
-	Would normally be in seperate files to be loaded but can only upload the one .c file so has to be put in functions	
+	Would normally be in seperate files to be loaded but can only upload the one .c file, so the patterns are compiled in as tables.
+	Each table was generated from the pattern's RLE, given in the comment above it. Row words have bit j set for a live cell in column j.
+	Patterns and samplers from https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life
+*/
+/* glider, moves one cell diagonally every 4 generations: bo$2bo$3o! */
+static const unsigned long long pattern_glider[] = {0x2, 0x4, 0x7};
+/* Gosper glider gun, fires a glider every 30 generations: 24bo$22bobo$12b2o6b2o12b2o$11bo3bo4b2o12b2o$2o8bo5bo3b2o$2o8bo3bob2o4bobo$10bo5bo7bo$11bo3bo$12b2o! */
+static const unsigned long long pattern_gosper_gun[] = {0x1000000, 0x1400000, 0xc00303000, 0xc00308800, 0x310403, 0x1434403, 0x1010400, 0x8800, 0x3000};
+/* R-pentomino, methuselah that settles after 1103 generations: b2o$2o$bo! */
+static const unsigned long long pattern_r_pentomino[] = {0x6, 0x3, 0x2};
+/* diehard, methuselah that vanishes after 130 generations: 6bo$2o$bo3b3o! */
+static const unsigned long long pattern_diehard[] = {0x40, 0x3, 0xe2};
+/* acorn, methuselah that settles after 5206 generations: bo$3bo$2o2b3o! */
+static const unsigned long long pattern_acorn[] = {0x2, 0x8, 0x73};
+/* blinker, period 2: 3o! */
+static const unsigned long long pattern_blinker[] = {0x7};
+/* toad, period 2: 2bo$o2bo$o2bo$bo! */
+static const unsigned long long pattern_toad[] = {0x4, 0x9, 0x9, 0x2};
+/* beacon, period 2: 2o$o$3bo$2b2o! */
+static const unsigned long long pattern_beacon[] = {0x3, 0x1, 0x8, 0xc};
+/* penta-decathlon, period 15: b3o$o3bo$o3bo$b3o5$b3o$o3bo$o3bo$b3o! */
+static const unsigned long long pattern_pentadecathlon[] = {0xe, 0x11, 0x11, 0xe, 0x0, 0x0, 0x0, 0x0, 0xe, 0x11, 0x11, 0xe};
+/* pulsar, period 3: 4bo5bo$4bo5bo$4b2o3b2o2$3o2b2ob2o2b3o$2bobobobobobo$4b2o3b2o2$4b2o3b2o$2bobobobobobo$3o2b2ob2o2b3o2$4b2o3b2o$4bo5bo$4bo5bo! */
+static const unsigned long long pattern_pulsar[] = {0x410, 0x410, 0x630, 0x0, 0x7367, 0x1554, 0x630, 0x0, 0x630, 0x1554, 0x7367, 0x0, 0x630, 0x410, 0x410};
+/* light weight spaceship: o2bo$4bo$o3bo$b4o! */
+static const unsigned long long pattern_lwss[] = {0x9, 0x10, 0x11, 0x1e};
+/* middle weight spaceship: b5o$o4bo$5bo$o3bo$2bo! */
+static const unsigned long long pattern_mwss[] = {0x3e, 0x21, 0x20, 0x11, 0x4};
+/* heavy weight spaceship: b6o$o5bo$6bo$o4bo$2b2o! */
+static const unsigned long long pattern_hwss[] = {0x7e, 0x41, 0x40, 0x21, 0xc};
+
+static const pattern Library[] = {
+	{"glider", 3, 3, pattern_glider},
+	{"gosper_gun", 9, 36, pattern_gosper_gun},
+	{"r_pentomino", 3, 3, pattern_r_pentomino},
+	{"diehard", 3, 8, pattern_diehard},
+	{"acorn", 3, 7, pattern_acorn},
+	{"blinker", 1, 3, pattern_blinker},
+	{"toad", 4, 4, pattern_toad},
+	{"beacon", 4, 4, pattern_beacon},
+	{"pentadecathlon", 12, 5, pattern_pentadecathlon},
+	{"pulsar", 15, 15, pattern_pulsar},
+	{"lwss", 4, 5, pattern_lwss},
+	{"mwss", 5, 6, pattern_mwss},
+	{"hwss", 5, 7, pattern_hwss},
+};
+
+static const placement OscillatorSampler[] = { //different oscillators on one 32x32 board
+	{"blinker", 1, 13},
+	{"toad", 7, 1},
+	{"beacon", 1, 26},
+	{"pentadecathlon", 18, 1},
+	{"pulsar", 9, 10},
+};
+
+static const placement SpaceshipSampler[] = { //different spaceships on one 32x32 board
+	{"lwss", 1, 3},
+	{"mwss", 10, 2},
+	{"hwss", 20, 1},
+};
+
+//looks up a library pattern by name
+const pattern *PatternFind(const char *name){
+	for(uint k=0; k<sizeof(Library) / sizeof(Library[0]); ++k){
+		if(strcmp(Library[k].name, name) == 0) return &Library[k];
+	}
+	return NULL;
+}
+
+//stamps a pattern with its top left corner at (i0, j0), turned rotation quarter turns clockwise and cut off at the edge of the board
+void PatternStamp(board_cell **Board, uint board_size[N], const pattern *pat, uint i0, uint j0, int rotation){
+	if(i0 >= board_size[0] || j0 >= board_size[1]) return;
+	for(uint r=0; r<pat->rows; ++r){
+		for(unsigned long long bits = pat->bits[r]; bits != 0; bits &= bits - 1){ //visits only the live cells, clearing each one off the word
+			uint c = LowestBit(bits);
+			uint i, j;
+			switch(rotation){
+				case 1:
+					i = c;
+					j = pat->rows - 1 - r;
+					break;
+				case 2:
+					i = pat->rows - 1 - r;
+					j = pat->cols - 1 - c;
+					break;
+				case 3:
+					i = pat->cols - 1 - c;
+					j = r;
+					break;
+				default:
+					i = r;
+					j = c;
+					break;
+			}
+			if(i0 + i < board_size[0] && j0 + j < board_size[1]) ScriptCell(Board, i0 + i, j0 + j, 1);
+		}//c loop
+	}//r loop
+}
+
+uint LowestBit(unsigned long long bits){
+#if defined(__GNUC__)
+	return (uint)__builtin_ctzll(bits);
+#else
+	uint c = 0;
+	while((bits & 1) == 0){
+		bits >>= 1;
+		++c;
+	}
+	return c;
+#endif
+}
+
+void BoardOscillatorLoad(board_cell **Board, uint board_size[N], uint i0, uint j0){
+	for(uint k=0; k<sizeof(OscillatorSampler) / sizeof(OscillatorSampler[0]); ++k){
+		PatternStamp(Board, board_size, PatternFind(OscillatorSampler[k].name), i0 + OscillatorSampler[k].i, j0 + OscillatorSampler[k].j, 0);
+	}
+}
+
+void BoardSpaceshipLoad(board_cell **Board, uint board_size[N], uint i0, uint j0){
+	for(uint k=0; k<sizeof(SpaceshipSampler) / sizeof(SpaceshipSampler[0]); ++k){
+		PatternStamp(Board, board_size, PatternFind(SpaceshipSampler[k].name), i0 + SpaceshipSampler[k].i, j0 + SpaceshipSampler[k].j, 0);
+	}
+}
+
+/*		Verification functions
+	BoardScan/neighbour/iadd/jadd are the reference, every other engine has to give the same board every generation.
+	The density table viewport mode draws from is checked against counting cells directly on the same random boards.
+	Run with "verify [cases] [generations] [seed]".
 */
-void BoardOscillatorLoad(board_cell **Board){ //different oscillators on one board
-	/*BOARD SETUP FOR THIS EXAMPLE.	FROM https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life		*/
-
-	//blinker period 1
-	Board[1][13].next_gen= 1;
-	Board[1][14].next_gen= 1;
-	Board[1][15].next_gen= 1;
-	//toad period 2
-
-	Board[7][3].next_gen= 1;
-	Board[8][4].next_gen= 1;
-	Board[9][4].next_gen= 1;
-	Board[8][1].next_gen= 1;
-	Board[9][1].next_gen= 1;
-	Board[10][2].next_gen= 1;
-
-	//beacon period 2
-	Board[1][26].next_gen= 1;
-	Board[1][27].next_gen= 1;
-	Board[2][26].next_gen= 1;
-	Board[3][29].next_gen= 1;
-	Board[4][29].next_gen= 1;
-	Board[4][28].next_gen= 1;
-
-	//penta-decathlon period 15
-	Board[18][2].next_gen= 1;
-	Board[18][3].next_gen= 1;
-	Board[18][4].next_gen= 1;
-	Board[19][1].next_gen= 1;
-	Board[20][1].next_gen= 1;
-	Board[19][5].next_gen= 1;
-	Board[20][5].next_gen= 1;
-	Board[21][2].next_gen= 1;
-	Board[21][3].next_gen= 1;
-	Board[21][4].next_gen= 1;
-	Board[26][2].next_gen= 1;
-	Board[26][3].next_gen= 1;
-	Board[26][4].next_gen= 1;
-	Board[27][5].next_gen= 1;
-	Board[28][5].next_gen= 1;
-	Board[27][1].next_gen= 1;
-	Board[28][1].next_gen= 1;
-	Board[29][2].next_gen= 1;
-	Board[29][3].next_gen= 1;
-	Board[29][4].next_gen= 1;
-
-	//pulsar period 3
-	Board[9][14].next_gen= 1;
-	Board[10][14].next_gen= 1;
-	Board[11][14].next_gen= 1;
-	Board[11][15].next_gen= 1;
-	Board[9][20].next_gen= 1;
-	Board[10][20].next_gen= 1;
-	Board[11][20].next_gen= 1;
-	Board[11][19].next_gen= 1;
-	Board[13][10].next_gen= 1;
-	Board[13][11].next_gen= 1;
-	Board[13][12].next_gen= 1;
-	Board[14][12].next_gen= 1;
-	Board[18][12].next_gen= 1;
-	Board[19][12].next_gen= 1;
-	Board[19][11].next_gen= 1;
-	Board[19][10].next_gen= 1;
-	Board[21][14].next_gen= 1;
-	Board[21][14].next_gen= 1;
-	Board[21][15].next_gen= 1;
-	Board[22][14].next_gen= 1;
-	Board[23][14].next_gen= 1;
-	Board[21][19].next_gen= 1;
-	Board[21][20].next_gen= 1;
-	Board[22][20].next_gen= 1;
-	Board[23][20].next_gen= 1;
-	Board[13][15].next_gen= 1;
-	Board[13][15].next_gen= 1;
-	Board[13][16].next_gen= 1;
-	Board[13][16].next_gen= 1;
-	Board[14][14].next_gen= 1;
-	Board[15][14].next_gen= 1;
-	Board[14][14].next_gen= 1;
-	Board[15][15].next_gen= 1;
-	Board[13][18].next_gen= 1;
-	Board[13][19].next_gen= 1;
-	Board[14][18].next_gen= 1;
-	Board[14][20].next_gen= 1;
-	Board[15][20].next_gen= 1;
-	Board[15][19].next_gen= 1;
-	Board[17][19].next_gen= 1;
-	Board[17][19].next_gen= 1;
-	Board[17][20].next_gen= 1;
-	Board[18][20].next_gen= 1;
-	Board[18][18].next_gen= 1;
-	Board[19][18].next_gen= 1;
-	Board[19][19].next_gen= 1;
-	Board[13][22].next_gen= 1;
-	Board[13][22].next_gen= 1;
-	Board[13][23].next_gen= 1;
-	Board[13][24].next_gen= 1;
-	Board[14][22].next_gen= 1;
-	Board[18][22].next_gen= 1;
-	Board[19][22].next_gen= 1;
-	Board[19][22].next_gen= 1;
-	Board[19][23].next_gen= 1;
-	Board[19][24].next_gen= 1;
-	Board[17][14].next_gen= 1;
-	Board[17][15].next_gen= 1;
-	Board[18][14].next_gen= 1;
-	Board[18][16].next_gen= 1;
-	Board[19][15].next_gen= 1;
-	Board[19][16].next_gen= 1;
-	Board[14][16].next_gen= 1;
-}
-
-
-void BoardSpaceshipLoad(board_cell **Board){ //different spaceships on one board
-	/*	Spaceships from https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life 	*/
-	//light spaceship
-	Board[1][3].next_gen = 1;
-	Board[1][6].next_gen = 1;
-	Board[2][7].next_gen = 1;
-	Board[3][3].next_gen = 1;
-	Board[3][7].next_gen = 1;
-	Board[4][4].next_gen = 1;
-	Board[4][5].next_gen = 1;
-	Board[4][6].next_gen = 1;
-	Board[4][7].next_gen = 1;
-
-	//medium spaceship
-	Board[10][3].next_gen = 1;
-	Board[10][4].next_gen = 1;
-	Board[10][5].next_gen = 1;
-	Board[10][6].next_gen = 1;
-	Board[10][7].next_gen = 1;
-	Board[11][2].next_gen = 1;
-	Board[11][7].next_gen = 1;
-	Board[12][7].next_gen = 1;
-	Board[13][2].next_gen = 1;
-	Board[13][6].next_gen = 1;
-	Board[14][4].next_gen = 1;
-
-	//heavy spaceship
-	Board[20][2].next_gen = 1;
-	Board[20][3].next_gen = 1;
-	Board[20][4].next_gen = 1;
-	Board[20][5].next_gen = 1;
-	Board[20][6].next_gen = 1;
-	Board[20][7].next_gen = 1;
-	Board[21][1].next_gen = 1;
-	Board[21][7].next_gen = 1;
-	Board[22][7].next_gen = 1;
-	Board[23][1].next_gen = 1;
-	Board[23][6].next_gen = 1;
-	Board[24][3].next_gen = 1;
-	Board[24][4].next_gen = 1;
-}
\ No newline at end of file
+static const engine Engines[] = {
+	{"fast scan", StepFast},
+	{"fast scan with density table", StepFastDensity},
+};
+
+//the original generation step, as Ticker did it before any faster engine existed
+void StepReference(board_cell **Board, uint board_size[N], step_tables *tables){
+	BoardScan(Board, board_size);
+	BoardUpdate(Board, board_size);
+	ClearNextGen(Board, board_size);
+}
+
+void StepFast(board_cell **Board, uint board_size[N], step_tables *tables){
+	BoardScanFast(Board, board_size, tables->left, tables->right);
+	BoardUpdate(Board, board_size);
+	ClearNextGen(Board, board_size);
+}
+
+//the viewport mode step, as Ticker runs it
+void StepFastDensity(board_cell **Board, uint board_size[N], step_tables *tables){
+	BoardScanFast(Board, board_size, tables->left, tables->right);
+	BoardUpdateDensity(Board, board_size, tables->Density);
+	ClearNextGen(Board, board_size);
+}
+
+void BoardCopy(board_cell **Dest, board_cell **Source, uint board_size[N]){
+	for(uint i=0; i<board_size[0]; ++i){
+		for(uint j=0; j<board_size[1]; ++j){
+			Dest[i][j] = Source[i][j];
+		}//j loop
+	}//i loop
+}
+
+unsigned long long BoardHash(board_cell **Board, uint board_size[N]){
+	unsigned long long hash = 14695981039346656037ULL;
+	for(uint i=0; i<board_size[0]; ++i){
+		for(uint j=0; j<board_size[1]; ++j){
+			hash ^= (unsigned long long)Board[i][j].status;
+			hash *= 1099511628211ULL;
+		}//j loop
+	}//i loop
+	return hash;
+}
+
+//runs the reference and one engine side by side from the same start, comparing board hashes every generation
+uint VerifyRun(board_cell **Start, uint board_size[N], board_step step, uint generations){
+	board_cell **Ref = GenerateBoard(board_size);
+	board_cell **Test = GenerateBoard(board_size);
+	step_tables tables; //made once per run, the same way Ticker does
+	tables.left = GenerateWrap(board_size, -1);
+	tables.right = GenerateWrap(board_size, 1);
+	tables.Density = GenerateDensity(board_size);
+	uint mismatch = 0;
+	BoardCopy(Ref, Start, board_size);
+	BoardCopy(Test, Start, board_size);
+	for(uint Gen=1; Gen<=generations; ++Gen){
+		StepReference(Ref, board_size, &tables);
+		step(Test, board_size, &tables);
+		if(BoardHash(Ref, board_size) != BoardHash(Test, board_size)){
+			mismatch = Gen;
+			break;
+		}
+	}
+	FreeMemory(Ref, board_size);
+	FreeMemory(Test, board_size);
+	free(tables.left);
+	free(tables.right);
+	FreeDensity(tables.Density, board_size);
+	return mismatch;
+}
+
+//kills live cells of a failing start one at a time, keeping each kill that still fails, then prints what is left
+void VerifyReduce(board_cell **Start, uint board_size[N], board_step step, uint generation){
+	uint size[N] = {board_size[0], board_size[1]}; //works on its own copy, cropping changes the size
+	board_cell **Case = GenerateBoard(size);
+	BoardCopy(Case, Start, size);
+
+	int shrunk = 1;
+	while(shrunk == 1){
+		shrunk = 0;
+		for(uint i=0; i<size[0]; ++i){
+			for(uint j=0; j<size[1]; ++j){
+				if(Case[i][j].status != 1) continue;
+				ScriptCell(Case, i, j, 0);
+				uint Gen = VerifyRun(Case, size, step, generation);
+				if(Gen == 0) ScriptCell(Case, i, j, 1); //needed for the failure, put it back
+				else generation = Gen;
+			}//j loop
+		}//i loop
+
+		for(uint side=0; side<4; ++side){ //drop the first row, last row, first column or last column while it still fails
+			uint crop[N] = {size[0] - (side < 2), size[1] - (side >= 2)};
+			uint di = side == 0;
+			uint dj = side == 2;
+			if(crop[0] == 0 || crop[1] == 0) continue;
+			board_cell **Cropped = GenerateBoard(crop);
+			for(uint i=0; i<crop[0]; ++i){
+				for(uint j=0; j<crop[1]; ++j){
+					Cropped[i][j] = Case[i + di][j + dj];
+				}//j loop
+			}//i loop
+			uint Gen = VerifyRun(Cropped, crop, step, generation);
+			if(Gen == 0){
+				FreeMemory(Cropped, crop);
+				continue;
+			}
+			FreeMemory(Case, size);
+			Case = Cropped;
+			size[0] = crop[0];
+			size[1] = crop[1];
+			generation = Gen;
+			shrunk = 1;
+		}//side loop
+	}
+
+	printf("  minimal failing case: %ux%u board, differs at generation %u, live cells (i j):", size[0], size[1], generation);
+	for(uint i=0; i<size[0]; ++i){
+		for(uint j=0; j<size[1]; ++j){
+			if(Case[i][j].status == 1) printf(" (%u %u)", i, j);
+		}//j loop
+	}//i loop
+	printf("\n");
+	FreeMemory(Case, size);
+}
+
+//runs the viewport mode step and checks every block a viewport could ask for against counting its cells one by one.
+//Zooms that divide the board evenly and ones that don't, from corners where the blocks wrap around, returns 1 on the first bad block
+int VerifyDensity(board_cell **Start, uint board_size[N], uint generations, const char *label){
+	uint zooms[] = {1, 2, 3, 4, 5, 7, 8, 16, 64, board_size[0], board_size[1], board_size[0] + 1};
+	uint corners[][N] = {{0, 0}, {board_size[0] - 1, board_size[1] - 1}, {board_size[0] / 2, board_size[1] / 3}};
+	board_cell **Board = GenerateBoard(board_size);
+	step_tables tables;
+	tables.left = GenerateWrap(board_size, -1);
+	tables.right = GenerateWrap(board_size, 1);
+	tables.Density = GenerateDensity(board_size);
+	int failed = 0;
+	BoardCopy(Board, Start, board_size);
+
+	for(uint Gen=1; Gen<=generations && failed == 0; ++Gen){
+		StepFastDensity(Board, board_size, &tables);
+		for(uint z=0; z<sizeof(zooms) / sizeof(zooms[0]) && failed == 0; ++z){
+			uint zoom = zooms[z];
+			uint h = zoom < board_size[0] ? zoom : board_size[0]; //same clamping as PrintBoardViewport
+			uint w = zoom < board_size[1] ? zoom : board_size[1];
+			for(uint k=0; k<sizeof(corners) / sizeof(corners[0]) && failed == 0; ++k){
+				for(uint r=0; r<(board_size[0] + zoom - 1) / zoom && failed == 0; ++r){
+					uint i = (uint)iadd(corners[k][0], (r * zoom) % board_size[0], board_size);
+					for(uint c=0; c<(board_size[1] + zoom - 1) / zoom && failed == 0; ++c){
+						uint j = (uint)jadd(corners[k][1], (c * zoom) % board_size[1], board_size);
+						uint counted = 0;
+						for(uint p=0; p<h; ++p){
+							for(uint q=0; q<w; ++q){
+								counted += Board[iadd(i, p, board_size)][jadd(j, q, board_size)].status;
+							}//q loop
+						}//p loop
+						uint table = DensityCount(tables.Density, board_size, i, j, h, w);
+						if(table != counted){
+							printf("MISMATCH: density table on %s (%ux%u) at generation %u, zoom %u block at (%u %u): table says %u, counted %u\n",
+								label, board_size[0], board_size[1], Gen, zoom, i, j, table, counted);
+							failed = 1;
+						}
+					}//c loop
+				}//r loop
+			}//k loop
+		}//z loop
+	}
+
+	FreeMemory(Board, board_size);
+	free(tables.left);
+	free(tables.right);
+	FreeDensity(tables.Density, board_size);
+	return failed;
+}
+
+//checks every engine on one starting board, returns how many of them disagree with the reference
+int VerifyCase(board_cell **Start, uint board_size[N], uint generations, const char *label){
+	int failed = 0;
+	for(uint k=0; k<sizeof(Engines) / sizeof(Engines[0]); ++k){
+		uint Gen = VerifyRun(Start, board_size, Engines[k].step, generations);
+		if(Gen == 0) continue;
+		++failed;
+		printf("MISMATCH: %s differs from the reference on %s (%ux%u) at generation %u\n", Engines[k].name, label, board_size[0], board_size[1], Gen);
+		VerifyReduce(Start, board_size, Engines[k].step, Gen);
+	}
+	return failed;
+}
+
+//random boards of awkward sizes, then the predefined boards and library patterns
+int VerifyRandom(uint board_size[N], float density, uint generations, const char *label){
+	board_cell **Start = GenerateBoard(board_size);
+	ScriptRandom(Start, board_size, 0, 0, board_size[0], board_size[1], density);
+	int failed = VerifyCase(Start, board_size, generations, label);
+	failed += VerifyDensity(Start, board_size, 3, label); //a few generations is enough, the table is rebuilt from scratch each time
+	FreeMemory(Start, board_size);
+	return failed;
+}
+int VerifyEngines(uint cases, uint generations, uint seed){
+	static const uint odd_sizes[][N] = { //single rows/columns, tori small enough that neighbours wrap onto each other, widths around 64
+		{1,1}, {1,2}, {1,3}, {2,1}, {3,1}, {2,2}, {2,3}, {3,3}, {1,100}, {100,1}, {2,64},
+		{3,63}, {3,65}, {63,3}, {65,3}, {5,127}, {7,129}, {64,64}, {65,65}, {17,200},
+	};
+	static const float odd_densities[] = {0.0f, 0.05f, 0.15f, 0.3f, 0.5f, 0.7f, 0.9f, 1.0f}; //all dead, sparse, soup, crowded, all live
+	uint odd_count = sizeof(odd_sizes) / sizeof(odd_sizes[0]);
+	uint density_count = sizeof(odd_densities) / sizeof(odd_densities[0]);
+	uint odd_starts = 4; //random starts per size at each density strictly between 0 and 1
+	int failed = 0;
+	uint checked = 0;
+	char label[SMAX];
+
+	printf("Verifying %u engines against the reference, %u generations, seed %u\n",
+		(uint)(sizeof(Engines) / sizeof(Engines[0])), generations, seed);
+	srand(seed);
+
+	for(uint k=0; k<odd_count; ++k){ //one random start isn't enough here, a bug that needs a particular neighbourhood can hide at a single density
+		uint board_size[N] = {odd_sizes[k][0], odd_sizes[k][1]};
+		uint cells = board_size[0] * board_size[1];
+		if(cells <= 9){ //small enough to try every start
+			board_cell **Start = GenerateBoard(board_size);
+			for(uint bits=0; bits < (1u << cells); ++bits){
+				for(uint c=0; c<cells; ++c) ScriptCell(Start, c / board_size[1], c % board_size[1], (bits >> c) & 1);
+				snprintf(label, SMAX, "%ux%u board (start %u of every start)", board_size[0], board_size[1], bits);
+				failed += VerifyCase(Start, board_size, generations, label);
+				++checked;
+			}
+			FreeMemory(Start, board_size);
+		}
+		for(uint d=0; d<density_count; ++d){
+			uint starts = (odd_densities[d] > 0.0f && odd_densities[d] < 1.0f) ? odd_starts : 1; //all dead and all live only have one start
+			for(uint t=0; t<starts; ++t){
+				snprintf(label, SMAX, "%ux%u board (density %.2f, start %u)", board_size[0], board_size[1], odd_densities[d], t);
+				failed += VerifyRandom(board_size, odd_densities[d], generations, label);
+				++checked;
+			}//t loop
+		}//d loop
+	}//k loop
+
+	for(uint k=0; k<cases; ++k){
+		uint board_size[N];
+		board_size[0] = 1 + rand() % 130;
+		board_size[1] = 1 + rand() % 130;
+		float density = 0.1f + 0.5f * (float)rand() / RAND_MAX;
+		snprintf(label, SMAX, "random board %u (density %.2f)", k, density);
+		failed += VerifyRandom(board_size, density, generations, label);
+		++checked;
+	}
+
+	static const char *boards[] = {"oscillators", "spaceships", "glider", "gosper_gun", "r_pentomino", "diehard", "acorn"};
+	for(uint k=0; k<sizeof(boards) / sizeof(boards[0]); ++k){
+		uint board_size[N] = {32,32};
+		if(k >= 2){ //library patterns go on a board whose width isn't a multiple of 64 so they run into the wrap around
+			board_size[0] = 41;
+			board_size[1] = 67;
+		}
+		board_cell **Start = GenerateBoard(board_size);
+		LibraryStamp(Start, board_size, boards[k], k >= 2 ? 3 : 0, k >= 2 ? 5 : 0, 0);
+		snprintf(label, SMAX, "predefined board %s", boards[k]);
+		failed += VerifyCase(Start, board_size, generations * 4, label); //run these longer, they are where anything interesting happens
+		FreeMemory(Start, board_size);
+		++checked;
+	}
+
+	if(failed == 0) printf("All engines and the density table match the reference on %u boards\n", checked);
+	else printf("%i mismatches found\n", failed);
+	return failed == 0 ? 0 : 1;
+}